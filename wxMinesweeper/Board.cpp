@@ -0,0 +1,33 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pch.h"
+#include "Board.h"
+#include "DensityPyramid.h"
+
+BoardDensity::BoardDensity() = default;
+BoardDensity::~BoardDensity() = default;
+BoardDensity::BoardDensity(BoardDensity&& other) noexcept = default;
+BoardDensity& BoardDensity::operator=(BoardDensity&& other) noexcept = default;
+
+void BoardDensity::Create(const unsigned short width, const unsigned short height)
+{
+	m_densityPyramid = std::make_unique<DensityPyramid>(width, height);
+}
+
+void BoardDensity::Destroy()
+{
+	m_densityPyramid.reset();
+}
+
+void BoardDensity::Reset()
+{
+	if (m_densityPyramid) m_densityPyramid->Reset();
+}
+
+void BoardDensity::UpdateCell(const unsigned short x, const unsigned short y, const CellDisplayState previousState,
+	const CellDisplayState state)
+{
+	if (m_densityPyramid) m_densityPyramid->UpdateCell(x, y, previousState, state);
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include "BoardTopology.h"
+#include <wx/debug.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+struct Cell
+{
+	bool hasMine{ false };
+	bool isRevealed{ false };
+	bool isFlagged{ false };
+	uint8_t adjacentMines{ 0 };
+};
+
+class DensityPyramid;
+
+// Owns a board's optional density pyramid. Defined in Board.cpp so that Board.h does not pull in the pyramid
+// and its wx headers.
+class BoardDensity final
+{
+public:
+	BoardDensity();
+	~BoardDensity();
+	BoardDensity(BoardDensity&& other) noexcept;
+	BoardDensity& operator=(BoardDensity&& other) noexcept;
+
+	[[nodiscard]] const DensityPyramid* Get() const { return m_densityPyramid.get(); }
+	explicit operator bool() const { return m_densityPyramid != nullptr; }
+	void Create(unsigned short width, unsigned short height);
+	void Destroy();
+	void Reset();
+	void UpdateCell(unsigned short x, unsigned short y, CellDisplayState previousState, CellDisplayState state);
+
+private:
+	std::unique_ptr<DensityPyramid> m_densityPyramid;
+};
+
+template <typename TTopology>
+class Board final
+{
+public:
+	// Empty boards are not playable, so both dimensions are clamped to at least one cell.
+	Board(const unsigned short width, const unsigned short height) :
+		m_width(std::max<unsigned short>(width, 1)), m_height(std::max<unsigned short>(height, 1)),
+		m_cells(static_cast<size_t>(m_width) * m_height)
+	{
+		wxASSERT_MSG(width > 0 && height > 0, "Board dimensions must be non-zero");
+	}
+
+	[[nodiscard]] unsigned short GetWidth() const { return m_width; }
+	[[nodiscard]] unsigned short GetHeight() const { return m_height; }
+	[[nodiscard]] unsigned int GetMineCount() const { return m_mineCount; }
+	[[nodiscard]] unsigned int GetFlagCount() const { return m_flagCount; }
+	[[nodiscard]] unsigned int GetRevealedCount() const { return m_revealedCount; }
+
+	[[nodiscard]] const Cell& GetCell(const unsigned short x, const unsigned short y) const
+	{
+		wxCHECK_MSG(x < m_width && y < m_height, s_outOfBoundsCell, "Cell is outside the board");
+
+		return m_cells[IndexOf(x, y)];
+	}
+
+	[[nodiscard]] const DensityPyramid* GetDensityPyramid() const { return m_density.Get(); }
+
+	// Creates the board's density pyramid from the current cells, so it can be enabled mid-game; from then on it
+	// is kept in step with every reveal and flag.
+	void EnableDensityPyramid()
+	{
+		if (m_density) return;
+
+		m_density.Create(m_width, m_height);
+
+		for (auto y = 0; y < m_height; y++)
+		{
+			for (auto x = 0; x < m_width; x++)
+			{
+				const auto& cell = m_cells[IndexOf(x, y)];
+
+				if (cell.isRevealed) m_density.UpdateCell(x, y, CELL_UNKNOWN, CELL_REVEALED);
+				else if (cell.isFlagged) m_density.UpdateCell(x, y, CELL_UNKNOWN, CELL_FLAGGED);
+			}
+		}
+	}
+
+	void DisableDensityPyramid() { m_density.Destroy(); }
+
+	template <typename TFunc>
+	void ForEachNeighbor(const unsigned short x, const unsigned short y, TFunc&& func) const
+	{
+		TTopology::ForEachNeighbor(m_width, m_height, x, y, std::forward<TFunc>(func));
+	}
+
+	// Places mines at random, keeping the cell at (safeX, safeY) clear so the first click never loses.
+	void PlaceMines(unsigned int mineCount, const unsigned short safeX, const unsigned short safeY, std::mt19937& rng)
+	{
+		wxCHECK_RET(safeX < m_width && safeY < m_height, "Safe cell is outside the board");
+
+		const auto safeIndex = IndexOf(safeX, safeY);
+		const auto cellCount = static_cast<unsigned int>(m_cells.size());
+
+		if (mineCount > cellCount - 1) mineCount = cellCount - 1;
+
+		std::vector<unsigned int> candidates;
+		candidates.reserve(cellCount - 1);
+
+		for (auto index = 0u; index < cellCount; index++)
+		{
+			m_cells[index] = {};
+			if (index != safeIndex) candidates.push_back(index);
+		}
+
+		// Partial Fisher-Yates: only the first mineCount slots need to be shuffled.
+		for (auto mineIndex = 0u; mineIndex < mineCount; mineIndex++)
+		{
+			std::uniform_int_distribution<unsigned int> distribution(mineIndex, static_cast<unsigned int>(candidates.size()) - 1);
+			std::swap(candidates[mineIndex], candidates[distribution(rng)]);
+			m_cells[candidates[mineIndex]].hasMine = true;
+		}
+
+		m_mineCount = mineCount;
+		m_flagCount = 0;
+		m_revealedCount = 0;
+
+		if (m_density) m_density.Reset();
+
+		for (auto y = 0; y < m_height; y++)
+		{
+			for (auto x = 0; x < m_width; x++)
+			{
+				auto& cell = m_cells[IndexOf(x, y)];
+				if (!cell.hasMine) continue;
+
+				ForEachNeighbor(x, y, [this](const unsigned short neighborX, const unsigned short neighborY)
+				{
+					m_cells[IndexOf(neighborX, neighborY)].adjacentMines++;
+				});
+			}
+		}
+	}
+
+	// Reveals the cell at (x, y), flooding outwards through cells with no adjacent mines. Returns true if a mine
+	// was revealed.
+	bool Reveal(const unsigned short x, const unsigned short y)
+	{
+		wxCHECK_MSG(x < m_width && y < m_height, false, "Cell is outside the board");
+
+		auto& cell = m_cells[IndexOf(x, y)];
+		if (cell.isRevealed || cell.isFlagged) return false;
+
+		cell.isRevealed = true;
+		m_revealedCount++;
+		if (m_density) m_density.UpdateCell(x, y, CELL_UNKNOWN, CELL_REVEALED);
+
+		if (cell.hasMine) return true;
+		if (cell.adjacentMines != 0) return false;
+
+		std::vector<std::pair<unsigned short, unsigned short>> pending{ { x, y } };
+
+		while (!pending.empty())
+		{
+			const auto [currentX, currentY] = pending.back();
+			pending.pop_back();
+
+			ForEachNeighbor(currentX, currentY, [this, &pending](const unsigned short neighborX, const unsigned short neighborY)
+			{
+				auto& neighbor = m_cells[IndexOf(neighborX, neighborY)];
+				if (neighbor.isRevealed || neighbor.isFlagged) return;
+
+				neighbor.isRevealed = true;
+				m_revealedCount++;
+				if (m_density) m_density.UpdateCell(neighborX, neighborY, CELL_UNKNOWN, CELL_REVEALED);
+
+				if (neighbor.adjacentMines == 0) pending.emplace_back(neighborX, neighborY);
+			});
+		}
+
+		return false;
+	}
+
+	void ToggleFlag(const unsigned short x, const unsigned short y)
+	{
+		wxCHECK_RET(x < m_width && y < m_height, "Cell is outside the board");
+
+		auto& cell = m_cells[IndexOf(x, y)];
+		if (cell.isRevealed) return;
+
+		cell.isFlagged = !cell.isFlagged;
+
+		if (cell.isFlagged)
+		{
+			m_flagCount++;
+			if (m_density) m_density.UpdateCell(x, y, CELL_UNKNOWN, CELL_FLAGGED);
+		}
+		else
+		{
+			m_flagCount--;
+			if (m_density) m_density.UpdateCell(x, y, CELL_FLAGGED, CELL_UNKNOWN);
+		}
+	}
+
+	[[nodiscard]] bool IsCleared() const { return m_revealedCount + m_mineCount == m_cells.size(); }
+
+private:
+	static inline const Cell s_outOfBoundsCell{};
+
+	unsigned short m_width;
+	unsigned short m_height;
+	unsigned int m_mineCount{ 0 };
+	unsigned int m_flagCount{ 0 };
+	unsigned int m_revealedCount{ 0 };
+	std::vector<Cell> m_cells;
+	BoardDensity m_density;
+
+	[[nodiscard]] size_t IndexOf(const unsigned short x, const unsigned short y) const
+	{
+		return static_cast<size_t>(y) * m_width + x;
+	}
+};
+
+// A board whose topology is chosen at run time (e.g. from the Custom dialog). Callers dispatch once with
+// std::visit and the visited code then runs against a fully specialized Board.
+using AnyBoard = std::variant<Board<SquareTopology>, Board<TorusTopology>, Board<HexTopology>>;
+
+inline AnyBoard MakeBoard(const BoardTopology topology, const unsigned short width, const unsigned short height)
+{
+	switch (topology)
+	{
+		case TOPOLOGY_TORUS:
+			return Board<TorusTopology>(width, height);
+
+		case TOPOLOGY_HEX:
+			return Board<HexTopology>(width, height);
+
+		case TOPOLOGY_SQUARE:
+		default:
+			return Board<SquareTopology>(width, height);
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+enum BoardTopology : uint8_t { TOPOLOGY_SQUARE, TOPOLOGY_TORUS, TOPOLOGY_HEX };
+enum CellDisplayState : uint8_t { CELL_UNKNOWN, CELL_REVEALED, CELL_FLAGGED };
+
+// Neighbour enumeration policies for Board. Each policy is a stateless type whose static ForEachNeighbor
+// is inlined into the board algorithms, so the choice of topology costs nothing at run time.
+
+struct SquareTopology
+{
+	template <typename TFunc>
+	static void ForEachNeighbor(const unsigned short width, const unsigned short height, const unsigned short x,
+		const unsigned short y, TFunc&& func)
+	{
+		const auto minX = x > 0 ? x - 1 : 0;
+		const auto maxX = x + 1 < width ? x + 1 : x;
+		const auto minY = y > 0 ? y - 1 : 0;
+		const auto maxY = y + 1 < height ? y + 1 : y;
+
+		for (auto neighborY = minY; neighborY <= maxY; neighborY++)
+		{
+			for (auto neighborX = minX; neighborX <= maxX; neighborX++)
+			{
+				if (neighborX == x && neighborY == y) continue;
+
+				func(static_cast<unsigned short>(neighborX), static_cast<unsigned short>(neighborY));
+			}
+		}
+	}
+};
+
+struct TorusTopology
+{
+	template <typename TFunc>
+	static void ForEachNeighbor(const unsigned short width, const unsigned short height, const unsigned short x,
+		const unsigned short y, TFunc&& func)
+	{
+		// On boards narrower or shorter than three cells the wrapped coordinates coincide, so only the distinct
+		// ones are visited.
+		std::array<unsigned short, 3> columns{};
+		std::array<unsigned short, 3> rows{};
+		const auto columnCount = WrappedCoordinates(x, width, columns);
+		const auto rowCount = WrappedCoordinates(y, height, rows);
+
+		for (auto rowIndex = 0; rowIndex < rowCount; rowIndex++)
+		{
+			for (auto columnIndex = 0; columnIndex < columnCount; columnIndex++)
+			{
+				if (columns[columnIndex] == x && rows[rowIndex] == y) continue;
+
+				func(columns[columnIndex], rows[rowIndex]);
+			}
+		}
+	}
+
+private:
+	static int WrappedCoordinates(const unsigned short value, const unsigned short extent,
+		std::array<unsigned short, 3>& coordinates)
+	{
+		coordinates[0] = static_cast<unsigned short>(value == 0 ? extent - 1 : value - 1);
+		coordinates[1] = value;
+		coordinates[2] = static_cast<unsigned short>(value + 1 == extent ? 0 : value + 1);
+
+		if (extent >= 3) return 3;
+		if (extent == 2) return 2;
+		return 1;
+	}
+};
+
+// Hexagonal cells in "odd-r" offset layout: odd rows are shifted half a cell to the right.
+struct HexTopology
+{
+	template <typename TFunc>
+	static void ForEachNeighbor(const unsigned short width, const unsigned short height, const unsigned short x,
+		const unsigned short y, TFunc&& func)
+	{
+		static constexpr std::array<std::array<int, 2>, 6> s_evenRowOffsets = { {
+			{-1, -1}, {0, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}
+		} };
+		static constexpr std::array<std::array<int, 2>, 6> s_oddRowOffsets = { {
+			{0, -1}, {1, -1}, {-1, 0}, {1, 0}, {0, 1}, {1, 1}
+		} };
+
+		for (const auto& [offsetX, offsetY] : (y & 1) ? s_oddRowOffsets : s_evenRowOffsets)
+		{
+			const auto neighborX = x + offsetX;
+			const auto neighborY = y + offsetY;
+
+			if (neighborX < 0 || neighborX >= width || neighborY < 0 || neighborY >= height) continue;
+
+			func(static_cast<unsigned short>(neighborX), static_cast<unsigned short>(neighborY));
+		}
+	}
+};
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pch.h"
+#include "DensityPyramid.h"
+#include <algorithm>
+
+DensityPyramid::DensityPyramid(const unsigned short width, const unsigned short height) :
+	m_width(width), m_height(height)
+{
+	auto shift = s_baseShift;
+
+	while (true)
+	{
+		const auto blockSize = 1u << shift;
+		const auto levelWidth = static_cast<unsigned short>((width + blockSize - 1) >> shift);
+		const auto levelHeight = static_cast<unsigned short>((height + blockSize - 1) >> shift);
+		const auto countCount = static_cast<size_t>(levelWidth) * levelHeight * 2;
+		const auto maxCount = static_cast<uint64_t>(blockSize) * blockSize;
+
+		Counts counts;
+
+		if (maxCount <= UINT8_MAX) counts = std::vector<uint8_t>(countCount);
+		else if (maxCount <= UINT16_MAX) counts = std::vector<uint16_t>(countCount);
+		else counts = std::vector<uint32_t>(countCount);
+
+		m_levels.push_back({ levelWidth, levelHeight, shift, std::move(counts) });
+
+		if (levelWidth <= 1 && levelHeight <= 1) break;
+
+		shift++;
+	}
+}
+
+void DensityPyramid::Reset()
+{
+	for (auto& level : m_levels)
+	{
+		std::visit([](auto& counts) { std::ranges::fill(counts, 0); }, level.counts);
+	}
+}
+
+void DensityPyramid::UpdateCell(const unsigned short x, const unsigned short y, const CellDisplayState previousState,
+	const CellDisplayState state)
+{
+	wxCHECK_RET(x < m_width && y < m_height, "Cell is outside the pyramid");
+	if (previousState == state) return;
+
+	for (auto& level : m_levels)
+	{
+		const auto nodeIndex = (static_cast<size_t>(y >> level.shift) * level.width + (x >> level.shift)) * 2;
+
+		std::visit([&](auto& counts)
+		{
+			if (previousState == CELL_REVEALED)
+			{
+				wxASSERT_MSG(counts[nodeIndex] != 0, "Revealed count underflow; previous state is wrong");
+				counts[nodeIndex]--;
+			}
+			else if (previousState == CELL_FLAGGED)
+			{
+				wxASSERT_MSG(counts[nodeIndex + 1] != 0, "Flagged count underflow; previous state is wrong");
+				counts[nodeIndex + 1]--;
+			}
+
+			if (state == CELL_REVEALED) counts[nodeIndex]++;
+			else if (state == CELL_FLAGGED) counts[nodeIndex + 1]++;
+		}, level.counts);
+	}
+}
+
+wxSize DensityPyramid::GetLevelSize(const unsigned short level) const
+{
+	return { m_levels[level].width, m_levels[level].height };
+}
+
+unsigned short DensityPyramid::GetLevelForSize(const wxSize maxSize) const
+{
+	for (auto levelIndex = 0u; levelIndex < m_levels.size(); levelIndex++)
+	{
+		if (m_levels[levelIndex].width <= maxSize.GetWidth() && m_levels[levelIndex].height <= maxSize.GetHeight())
+		{
+			return static_cast<unsigned short>(levelIndex);
+		}
+	}
+
+	return static_cast<unsigned short>(m_levels.size() - 1);
+}
+
+wxImage DensityPyramid::RenderImage(const wxSize maxSize) const
+{
+	const auto& level = m_levels[GetLevelForSize(maxSize)];
+	if (level.width == 0 || level.height == 0) return {};
+
+	wxImage image(level.width, level.height, false);
+
+	const wxColour unknownColor(128, 128, 128);
+	const wxColour revealedColor(224, 224, 224);
+	const wxColour flaggedColor(255, 0, 0);
+
+	auto* pixel = image.GetData();
+
+	std::visit([&](const auto& counts)
+	{
+		for (auto y = 0; y < level.height; y++)
+		{
+			for (auto x = 0; x < level.width; x++)
+			{
+				const auto nodeIndex = (static_cast<size_t>(y) * level.width + x) * 2;
+				const uint64_t revealed = counts[nodeIndex];
+				const uint64_t flagged = counts[nodeIndex + 1];
+				const uint64_t total = GetNodeCellCount(level, static_cast<unsigned short>(x), static_cast<unsigned short>(y));
+				const auto unknown = total - revealed - flagged;
+
+				// Blocks can hold up to 2^32 cells, so the weighted sum needs 64 bits.
+				const auto blend = [&](const unsigned char unknownChannel, const unsigned char revealedChannel,
+					const unsigned char flaggedChannel)
+				{
+					return static_cast<unsigned char>((unknownChannel * unknown + revealedChannel * revealed + flaggedChannel * flagged) / total);
+				};
+
+				*pixel++ = blend(unknownColor.Red(), revealedColor.Red(), flaggedColor.Red());
+				*pixel++ = blend(unknownColor.Green(), revealedColor.Green(), flaggedColor.Green());
+				*pixel++ = blend(unknownColor.Blue(), revealedColor.Blue(), flaggedColor.Blue());
+			}
+		}
+	}, level.counts);
+
+	return image;
+}
+
+uint32_t DensityPyramid::GetNodeCellCount(const Level& level, const unsigned short x, const unsigned short y) const
+{
+	// Nodes along the right and bottom edges cover only the part of their block that lies on the board.
+	const auto blockSize = 1u << level.shift;
+	const auto originX = static_cast<uint32_t>(x) << level.shift;
+	const auto originY = static_cast<uint32_t>(y) << level.shift;
+	const auto spanX = std::min(blockSize, m_width - originX);
+	const auto spanY = std::min(blockSize, m_height - originY);
+
+	return spanX * spanY;
+}
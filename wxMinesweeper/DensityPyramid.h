@@ -0,0 +1,50 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <wx/wx.h>
+#include "BoardTopology.h"
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+// Mipmap pyramid of revealed/flagged counts used to draw zoomed-out views of large boards, such as Minimap. The
+// finest level covers 4x4 cell blocks and each further level halves both dimensions, so a cell change touches
+// one node per level and an image of any level costs only as much as its own size. Individual cell states are
+// not stored; the board reports each change together with the cell's previous state.
+class DensityPyramid final
+{
+public:
+	DensityPyramid(unsigned short width, unsigned short height);
+	[[nodiscard]] unsigned short GetWidth() const { return m_width; }
+	[[nodiscard]] unsigned short GetHeight() const { return m_height; }
+	void Reset();
+	void UpdateCell(unsigned short x, unsigned short y, CellDisplayState previousState, CellDisplayState state);
+	[[nodiscard]] unsigned short GetLevelCount() const { return static_cast<unsigned short>(m_levels.size()); }
+	[[nodiscard]] wxSize GetLevelSize(unsigned short level) const;
+	[[nodiscard]] unsigned int GetLevelBlockSize(const unsigned short level) const { return 1u << m_levels[level].shift; }
+	[[nodiscard]] unsigned short GetLevelForSize(wxSize maxSize) const;
+	[[nodiscard]] wxImage RenderImage(wxSize maxSize) const;
+
+private:
+	static constexpr unsigned short s_baseShift = 2;
+
+	// Revealed and flagged counts are interleaved per node. Each level uses the narrowest counter type that can
+	// hold its block size, which keeps the finest (largest) levels at two bytes per node.
+	using Counts = std::variant<std::vector<uint8_t>, std::vector<uint16_t>, std::vector<uint32_t>>;
+
+	struct Level
+	{
+		unsigned short width{ 0 };
+		unsigned short height{ 0 };
+		unsigned short shift{ 0 };
+		Counts counts;
+	};
+
+	unsigned short m_width;
+	unsigned short m_height;
+	std::vector<Level> m_levels;
+
+	[[nodiscard]] uint32_t GetNodeCellCount(const Level& level, unsigned short x, unsigned short y) const;
+};
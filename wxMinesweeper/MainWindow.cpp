@@ -78,6 +78,13 @@ MainWindow::MainWindow() : wxFrame(nullptr, wxID_ANY, "Minesweeper", wxDefaultPo
 
 	szrMainInner->Add(szrTop, wxSizerFlags(0).Expand());
 
+	szrMainInner->AddSpacer(12);
+
+	std::visit([](auto& board) { board.EnableDensityPyramid(); }, m_board);
+	m_minimap = new Minimap(this);
+	m_minimap->SetDensityPyramid(std::visit([](const auto& board) { return board.GetDensityPyramid(); }, m_board));
+	szrMainInner->Add(m_minimap, wxSizerFlags(0).CenterHorizontal());
+
 	szrMainInner->AddSpacer(12);
 	szrMainOuter->Add(szrMainInner, wxSizerFlags(1).Expand());
 	szrMainOuter->AddSpacer(12);
@@ -4,6 +4,8 @@
 
 #pragma once
 #include <wx/wx.h>
+#include "Board.h"
+#include "Minimap.h"
 #include "SevenSegmentDisplay.h"
 
 class MainWindow final : public wxFrame
@@ -16,6 +18,8 @@ private:
 	wxMenuBar* m_menuBar{};
 	SevenSegmentDisplay* m_ssdMinesLeft{};
 	SevenSegmentDisplay* m_ssdTimeElapsed{};
+	Minimap* m_minimap{};
+	AnyBoard m_board{ MakeBoard(TOPOLOGY_SQUARE, 30, 16) };
 
 	void MenuBar_OnItemSelect(wxCommandEvent& event);
 };
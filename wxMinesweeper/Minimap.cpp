@@ -0,0 +1,67 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pch.h"
+#include "Minimap.h"
+#include <wx/dcbuffer.h>
+#include <wx/graphics.h>
+#include <algorithm>
+
+Minimap::Minimap(wxWindow* parent)
+{
+	wxControl::SetBackgroundStyle(wxBG_STYLE_PAINT);
+	Create(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxFULL_REPAINT_ON_RESIZE | wxBORDER_NONE);
+	Bind(wxEVT_PAINT, &Minimap::Minimap_OnPaint, this);
+}
+
+void Minimap::SetDensityPyramid(const DensityPyramid* densityPyramid)
+{
+	if (m_densityPyramid == densityPyramid) return;
+
+	m_densityPyramid = densityPyramid;
+	InvalidateBestSize();
+	Refresh();
+}
+
+void Minimap::Minimap_OnPaint([[maybe_unused]] wxPaintEvent& event)
+{
+	const wxAutoBufferedPaintDC dc(this);
+	const auto gc = std::unique_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
+	if (!gc) return;
+
+	const auto clientSize = GetClientSize();
+
+	gc->SetBrush(GetParent()->GetBackgroundColour());
+	gc->SetPen(GetParent()->GetBackgroundColour());
+	gc->DrawRectangle(0, 0, clientSize.GetWidth(), clientSize.GetHeight());
+
+	if (!m_densityPyramid || m_densityPyramid->GetWidth() == 0 || m_densityPyramid->GetHeight() == 0) return;
+
+	const auto image = m_densityPyramid->RenderImage(clientSize);
+	if (!image.IsOk()) return;
+
+	// Fit the board's aspect ratio into the client area. Edge nodes cover blocks that overhang the board, so the
+	// image is drawn at its full block extent and clipped to the board.
+	const auto scale = std::min(static_cast<double>(clientSize.GetWidth()) / m_densityPyramid->GetWidth(),
+		static_cast<double>(clientSize.GetHeight()) / m_densityPyramid->GetHeight());
+	const auto blockSize = m_densityPyramid->GetLevelBlockSize(m_densityPyramid->GetLevelForSize(clientSize));
+	const auto boardWidth = m_densityPyramid->GetWidth() * scale;
+	const auto boardHeight = m_densityPyramid->GetHeight() * scale;
+	const auto originX = (clientSize.GetWidth() - boardWidth) / 2;
+	const auto originY = (clientSize.GetHeight() - boardHeight) / 2;
+
+	gc->Clip(originX, originY, boardWidth, boardHeight);
+	gc->SetInterpolationQuality(wxINTERPOLATION_NONE);
+	gc->DrawBitmap(wxBitmap(image), originX, originY, image.GetWidth() * blockSize * scale,
+		image.GetHeight() * blockSize * scale);
+}
+
+wxSize Minimap::DoGetBestClientSize() const
+{
+	if (!m_densityPyramid || m_densityPyramid->GetWidth() == 0) return { s_bestWidth, s_bestWidth / 2 };
+
+	const auto height = s_bestWidth * m_densityPyramid->GetHeight() / m_densityPyramid->GetWidth();
+
+	return { s_bestWidth, std::max(height, 1) };
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <wx/wx.h>
+#include "DensityPyramid.h"
+
+// Zoomed-out view of a board drawn from its density pyramid, so painting costs O(client pixels) regardless of
+// board size. The pyramid is owned by the board and must outlive the minimap or be cleared first.
+class Minimap final : public wxControl
+{
+public:
+	explicit Minimap(wxWindow* parent);
+	[[nodiscard]] const DensityPyramid* GetDensityPyramid() const { return m_densityPyramid; }
+	void SetDensityPyramid(const DensityPyramid* densityPyramid);
+
+private:
+	static constexpr int s_bestWidth = 120;
+
+	const DensityPyramid* m_densityPyramid{};
+
+	void Minimap_OnPaint(wxPaintEvent& event);
+	[[nodiscard]] wxSize DoGetBestClientSize() const override;
+};
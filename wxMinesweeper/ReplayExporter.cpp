@@ -0,0 +1,394 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pch.h"
+#include "ReplayExporter.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <future>
+#include <optional>
+#include <thread>
+
+// GIF frames share one fixed 6x7x6 colour cube, so frames can be mapped to palette indices independently of each
+// other (and therefore in parallel) without a quantization pass.
+static constexpr unsigned int s_redLevels = 6;
+static constexpr unsigned int s_greenLevels = 7;
+static constexpr unsigned int s_blueLevels = 6;
+
+static unsigned char ToPaletteIndex(const unsigned char red, const unsigned char green, const unsigned char blue)
+{
+	const auto redIndex = (red * (s_redLevels - 1) + 127) / 255;
+	const auto greenIndex = (green * (s_greenLevels - 1) + 127) / 255;
+	const auto blueIndex = (blue * (s_blueLevels - 1) + 127) / 255;
+
+	return static_cast<unsigned char>((redIndex * s_greenLevels + greenIndex) * s_blueLevels + blueIndex);
+}
+
+static void WriteUInt16(std::vector<unsigned char>& buffer, const unsigned int value)
+{
+	buffer.push_back(static_cast<unsigned char>(value & 0xFF));
+	buffer.push_back(static_cast<unsigned char>((value >> 8) & 0xFF));
+}
+
+static void WriteUInt32(std::vector<unsigned char>& buffer, const unsigned int value)
+{
+	WriteUInt16(buffer, value & 0xFFFF);
+	WriteUInt16(buffer, value >> 16);
+}
+
+static bool WriteBuffer(wxOutputStream& stream, const std::vector<unsigned char>& buffer)
+{
+	stream.Write(buffer.data(), buffer.size());
+
+	return stream.IsOk() && stream.LastWrite() == buffer.size();
+}
+
+ReplayExporter::ReplayExporter(FrameSource frameSource, const unsigned int frameCount, const unsigned int frameInterval) :
+	m_frameSource(std::move(frameSource)), m_frameCount(frameCount), m_frameInterval(frameInterval)
+{
+}
+
+bool ReplayExporter::Export(wxOutputStream& stream) const
+{
+	if (m_frameCount == 0 || !m_frameSource) return false;
+
+	const auto threadCount = m_threadCount != 0 ? m_threadCount : std::max(1u, std::thread::hardware_concurrency());
+
+	wxImage previous;
+	wxSize frameSize;
+	std::optional<Frame> pending;
+	std::vector<Frame> batch;
+	batch.reserve(threadCount);
+
+	for (auto frameIndex = 0u; frameIndex < m_frameCount;)
+	{
+		// Frames are fetched and diffed in order on this thread; only the encoding of a batch runs in parallel,
+		// so at most threadCount frames are held at once.
+		batch.clear();
+
+		while (batch.size() < threadCount && frameIndex < m_frameCount)
+		{
+			const auto image = m_frameSource(frameIndex * m_frameInterval);
+			frameIndex++;
+
+			if (!image.IsOk()) return false;
+
+			Frame frame;
+			frame.duration = m_frameInterval;
+
+			if (!previous.IsOk())
+			{
+				frameSize = image.GetSize();
+				if (frameSize.GetWidth() <= 0 || frameSize.GetHeight() <= 0) return false;
+				if (!WriteHeader(stream, frameSize)) return false;
+
+				frame.region = wxRect(frameSize);
+			}
+			else
+			{
+				if (image.GetSize() != frameSize) return false;
+
+				frame.region = GetChangedRegion(previous, image);
+			}
+
+			frame.pixels = CopyRegion(image, frame.region);
+			batch.push_back(std::move(frame));
+			previous = image;
+		}
+
+		if (threadCount > 1 && batch.size() > 1)
+		{
+			std::vector<std::future<void>> encoders;
+			encoders.reserve(batch.size());
+
+			for (auto& frame : batch)
+			{
+				encoders.push_back(std::async(std::launch::async, [this, &frame] { EncodeFrame(frame); }));
+			}
+
+			for (auto& encoder : encoders)
+			{
+				encoder.get();
+			}
+		}
+		else
+		{
+			for (auto& frame : batch)
+			{
+				EncodeFrame(frame);
+			}
+		}
+
+		for (auto& frame : batch)
+		{
+			if (frame.region.IsEmpty())
+			{
+				pending->duration += frame.duration;
+				continue;
+			}
+
+			if (pending && !WriteFrame(stream, *pending)) return false;
+
+			pending = std::move(frame);
+		}
+	}
+
+	if (pending && !WriteFrame(stream, *pending)) return false;
+
+	return WriteTrailer(stream);
+}
+
+void ReplayExporter::EncodeFrame(Frame& frame) const
+{
+	if (frame.region.IsEmpty()) return;
+
+	if (m_format == EXPORT_FORMAT_RAW)
+	{
+		frame.data = std::move(frame.pixels);
+		return;
+	}
+
+	std::vector<unsigned char> indices(frame.pixels.size() / 3);
+
+	for (size_t index = 0; index < indices.size(); index++)
+	{
+		indices[index] = ToPaletteIndex(frame.pixels[index * 3], frame.pixels[index * 3 + 1], frame.pixels[index * 3 + 2]);
+	}
+
+	frame.pixels.clear();
+	frame.pixels.shrink_to_fit();
+	frame.data = EncodeLzw(indices);
+}
+
+bool ReplayExporter::WriteHeader(wxOutputStream& stream, const wxSize frameSize) const
+{
+	std::vector<unsigned char> buffer;
+
+	if (m_format == EXPORT_FORMAT_RAW)
+	{
+		buffer.assign({ 'W', 'X', 'M', 'S', 'R', 'A', 'W', '1' });
+		WriteUInt16(buffer, frameSize.GetWidth());
+		WriteUInt16(buffer, frameSize.GetHeight());
+
+		return WriteBuffer(stream, buffer);
+	}
+
+	buffer.assign({ 'G', 'I', 'F', '8', '9', 'a' });
+	WriteUInt16(buffer, frameSize.GetWidth());
+	WriteUInt16(buffer, frameSize.GetHeight());
+	buffer.insert(buffer.end(), { 0xF7, 0x00, 0x00 });
+
+	for (auto redIndex = 0u; redIndex < s_redLevels; redIndex++)
+	{
+		for (auto greenIndex = 0u; greenIndex < s_greenLevels; greenIndex++)
+		{
+			for (auto blueIndex = 0u; blueIndex < s_blueLevels; blueIndex++)
+			{
+				buffer.push_back(static_cast<unsigned char>(redIndex * 255 / (s_redLevels - 1)));
+				buffer.push_back(static_cast<unsigned char>(greenIndex * 255 / (s_greenLevels - 1)));
+				buffer.push_back(static_cast<unsigned char>(blueIndex * 255 / (s_blueLevels - 1)));
+			}
+		}
+	}
+
+	buffer.resize(13 + 256 * 3, 0);
+
+	// NETSCAPE2.0 application extension: loop forever.
+	buffer.insert(buffer.end(), { 0x21, 0xFF, 0x0B, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 0x03, 0x01, 0x00, 0x00, 0x00 });
+
+	return WriteBuffer(stream, buffer);
+}
+
+bool ReplayExporter::WriteFrame(wxOutputStream& stream, const Frame& frame) const
+{
+	std::vector<unsigned char> buffer;
+
+	if (m_format == EXPORT_FORMAT_RAW)
+	{
+		WriteUInt32(buffer, frame.duration);
+		WriteUInt16(buffer, frame.region.GetX());
+		WriteUInt16(buffer, frame.region.GetY());
+		WriteUInt16(buffer, frame.region.GetWidth());
+		WriteUInt16(buffer, frame.region.GetHeight());
+
+		return WriteBuffer(stream, buffer) && WriteBuffer(stream, frame.data);
+	}
+
+	// Graphic control extension: leave the frame in place so the next frame only has to cover what changed.
+	buffer.insert(buffer.end(), { 0x21, 0xF9, 0x04, 0x04 });
+	WriteUInt16(buffer, std::min(65535u, (frame.duration + 5) / 10));
+	buffer.insert(buffer.end(), { 0x00, 0x00 });
+
+	buffer.push_back(0x2C);
+	WriteUInt16(buffer, frame.region.GetX());
+	WriteUInt16(buffer, frame.region.GetY());
+	WriteUInt16(buffer, frame.region.GetWidth());
+	WriteUInt16(buffer, frame.region.GetHeight());
+	buffer.push_back(0x00);
+
+	// LZW minimum code size, then the code stream in sub-blocks of at most 255 bytes.
+	buffer.push_back(0x08);
+	if (!WriteBuffer(stream, buffer)) return false;
+
+	std::array<unsigned char, 256> block{};
+
+	for (size_t offset = 0; offset < frame.data.size(); offset += 255)
+	{
+		const auto blockSize = std::min<size_t>(255, frame.data.size() - offset);
+		block[0] = static_cast<unsigned char>(blockSize);
+		std::memcpy(block.data() + 1, frame.data.data() + offset, blockSize);
+
+		stream.Write(block.data(), blockSize + 1);
+		if (!stream.IsOk()) return false;
+	}
+
+	stream.PutC(0x00);
+
+	return stream.IsOk();
+}
+
+bool ReplayExporter::WriteTrailer(wxOutputStream& stream) const
+{
+	if (m_format == EXPORT_FORMAT_RAW) return true;
+
+	stream.PutC(0x3B);
+
+	return stream.IsOk();
+}
+
+wxRect ReplayExporter::GetChangedRegion(const wxImage& previous, const wxImage& current)
+{
+	const auto width = current.GetWidth();
+	const auto height = current.GetHeight();
+	const auto* previousData = previous.GetData();
+	const auto* currentData = current.GetData();
+	const auto rowSize = static_cast<size_t>(width) * 3;
+
+	auto minX = width;
+	auto maxX = -1;
+	auto minY = height;
+	auto maxY = -1;
+
+	for (auto y = 0; y < height; y++)
+	{
+		const auto* previousRow = previousData + y * rowSize;
+		const auto* currentRow = currentData + y * rowSize;
+
+		if (std::memcmp(previousRow, currentRow, rowSize) == 0) continue;
+
+		minY = std::min(minY, y);
+		maxY = y;
+
+		for (auto x = 0; x < width; x++)
+		{
+			if (std::memcmp(previousRow + x * 3, currentRow + x * 3, 3) == 0) continue;
+
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+		}
+	}
+
+	if (maxY < 0) return {};
+
+	return { minX, minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+std::vector<unsigned char> ReplayExporter::CopyRegion(const wxImage& image, const wxRect& region)
+{
+	std::vector<unsigned char> pixels(static_cast<size_t>(region.GetWidth()) * region.GetHeight() * 3);
+	const auto* data = image.GetData();
+	const auto rowSize = static_cast<size_t>(region.GetWidth()) * 3;
+
+	for (auto y = 0; y < region.GetHeight(); y++)
+	{
+		const auto sourceOffset = (static_cast<size_t>(region.GetY() + y) * image.GetWidth() + region.GetX()) * 3;
+		std::memcpy(pixels.data() + y * rowSize, data + sourceOffset, rowSize);
+	}
+
+	return pixels;
+}
+
+std::vector<unsigned char> ReplayExporter::EncodeLzw(const std::vector<unsigned char>& indices)
+{
+	// Variable-length LZW as used by GIF, with 8-bit minimum code size. The string table is an open-addressed
+	// hash of (prefix code, next index) pairs, which keeps resets after a full table cheap.
+	static constexpr unsigned int s_clearCode = 256;
+	static constexpr unsigned int s_endCode = 257;
+	static constexpr unsigned int s_maxCode = 4095;
+	static constexpr size_t s_tableSize = 5003;
+
+	std::vector<unsigned char> output;
+	std::vector<int> tableKeys(s_tableSize, -1);
+	std::vector<unsigned short> tableCodes(s_tableSize);
+	auto codeSize = 9u;
+	auto lastCode = s_endCode;
+	uint32_t bitBuffer = 0;
+	auto bitCount = 0u;
+
+	const auto writeCode = [&](const unsigned int code)
+	{
+		bitBuffer |= code << bitCount;
+		bitCount += codeSize;
+
+		while (bitCount >= 8)
+		{
+			output.push_back(static_cast<unsigned char>(bitBuffer & 0xFF));
+			bitBuffer >>= 8;
+			bitCount -= 8;
+		}
+	};
+
+	writeCode(s_clearCode);
+	if (indices.empty())
+	{
+		writeCode(s_endCode);
+		if (bitCount > 0) output.push_back(static_cast<unsigned char>(bitBuffer & 0xFF));
+		return output;
+	}
+
+	unsigned int prefix = indices[0];
+
+	for (size_t index = 1; index < indices.size(); index++)
+	{
+		const auto next = indices[index];
+		const auto key = static_cast<int>((prefix << 8) | next);
+		auto slot = ((static_cast<size_t>(next) << 12) ^ prefix) % s_tableSize;
+
+		while (tableKeys[slot] != -1 && tableKeys[slot] != key)
+		{
+			slot = (slot + 1) % s_tableSize;
+		}
+
+		if (tableKeys[slot] == key)
+		{
+			prefix = tableCodes[slot];
+			continue;
+		}
+
+		writeCode(prefix);
+
+		tableKeys[slot] = key;
+		tableCodes[slot] = static_cast<unsigned short>(++lastCode);
+
+		if (lastCode >= (1u << codeSize)) codeSize++;
+
+		if (lastCode == s_maxCode)
+		{
+			writeCode(s_clearCode);
+			std::ranges::fill(tableKeys, -1);
+			codeSize = 9;
+			lastCode = s_endCode;
+		}
+
+		prefix = next;
+	}
+
+	writeCode(prefix);
+	writeCode(s_endCode);
+
+	if (bitCount > 0) output.push_back(static_cast<unsigned char>(bitBuffer & 0xFF));
+
+	return output;
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 David A. Frischknecht
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <wx/wx.h>
+#include <wx/stream.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+enum ReplayExportFormat : uint8_t { EXPORT_FORMAT_GIF, EXPORT_FORMAT_RAW };
+
+// Streams a replay to an animated GIF or a raw frame sequence. Frames are pulled one at a time from a frame
+// source and only the rectangle that changed since the previous frame is encoded, so memory use depends on the
+// frame size and thread count, never on the replay length. Frames whose pixels did not change extend the
+// duration of the previous frame instead of being written.
+//
+// The raw format is "WXMSRAW1", the frame width and height as little-endian 16-bit values, then for each frame
+// its duration in milliseconds (32-bit), the changed rectangle as x, y, width, height (16-bit each) and that
+// rectangle's RGB pixels row by row.
+class ReplayExporter final
+{
+public:
+	// Returns the frame shown at the given time, in milliseconds from the start of the replay. Always called on
+	// the exporting thread, in order. Each call must return an image that does not share data with the previous
+	// one, since the previous frame is kept for comparison.
+	using FrameSource = std::function<wxImage(unsigned int timestamp)>;
+
+	ReplayExporter(FrameSource frameSource, unsigned int frameCount, unsigned int frameInterval);
+	[[nodiscard]] ReplayExportFormat GetFormat() const { return m_format; }
+	void SetFormat(ReplayExportFormat format) { m_format = format; }
+	[[nodiscard]] unsigned short GetThreadCount() const { return m_threadCount; }
+	// Number of frames encoded in parallel; 0 uses one thread per core.
+	void SetThreadCount(unsigned short threadCount) { m_threadCount = threadCount; }
+	bool Export(wxOutputStream& stream) const;
+
+private:
+	struct Frame
+	{
+		wxRect region;
+		unsigned int duration{ 0 };
+		std::vector<unsigned char> pixels;
+		std::vector<unsigned char> data;
+	};
+
+	FrameSource m_frameSource;
+	unsigned int m_frameCount;
+	unsigned int m_frameInterval;
+	ReplayExportFormat m_format{ EXPORT_FORMAT_GIF };
+	unsigned short m_threadCount{ 1 };
+
+	void EncodeFrame(Frame& frame) const;
+	bool WriteHeader(wxOutputStream& stream, wxSize frameSize) const;
+	bool WriteFrame(wxOutputStream& stream, const Frame& frame) const;
+	bool WriteTrailer(wxOutputStream& stream) const;
+
+	[[nodiscard]] static wxRect GetChangedRegion(const wxImage& previous, const wxImage& current);
+	[[nodiscard]] static std::vector<unsigned char> CopyRegion(const wxImage& image, const wxRect& region);
+	[[nodiscard]] static std::vector<unsigned char> EncodeLzw(const std::vector<unsigned char>& indices);
+};
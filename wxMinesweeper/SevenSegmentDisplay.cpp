@@ -26,97 +26,137 @@ void SevenSegmentDisplay::SetValue(const unsigned short value)
 
 void SevenSegmentDisplay::SetDigitCount(const unsigned short digitCount)
 {
-	if (m_digitCount == digitCount) return;
+	if (m_layout.digitCount == digitCount) return;
 
-	m_digitCount = digitCount;
+	m_layout.digitCount = digitCount;
 	InvalidateBestSize();
 	Refresh();
 }
 
 void SevenSegmentDisplay::SetDigitSpacing(const unsigned short digitSpacing)
 {
-	if (m_digitSpacing == digitSpacing) return;
+	if (m_layout.digitSpacing == digitSpacing) return;
 
-	m_digitSpacing = digitSpacing;
+	m_layout.digitSpacing = digitSpacing;
 	InvalidateBestSize();
 	Refresh();
 }
 
 void SevenSegmentDisplay::SetSegmentThickness(const unsigned short segmentThickness)
 {
-	if (m_segmentThickness == segmentThickness) return;
+	if (m_layout.segmentThickness == segmentThickness) return;
 
-	m_segmentThickness = segmentThickness;
+	m_layout.segmentThickness = segmentThickness;
 	Refresh();
 }
 
 void SevenSegmentDisplay::SetDigitSize(const wxSize digitSize)
 {
-	if (m_digitSize == digitSize) return;
+	if (m_layout.digitSize == digitSize) return;
 
-	m_digitSize = digitSize;
+	m_layout.digitSize = digitSize;
 	InvalidateBestSize();
 	Refresh();
 }
 
 void SevenSegmentDisplay::SetLeadingZerosVisible(const bool leadingZerosVisible)
 {
-	if (m_leadingZerosVisible == leadingZerosVisible) return;
+	if (m_layout.leadingZerosVisible == leadingZerosVisible) return;
 
-	m_leadingZerosVisible = leadingZerosVisible;
+	m_layout.leadingZerosVisible = leadingZerosVisible;
 	Refresh();
 }
 
+SevenSegmentDisplay::Appearance SevenSegmentDisplay::GetAppearance() const
+{
+	return { m_layout, GetParent()->GetBackgroundColour(), GetBackgroundColour(), GetForegroundColour() };
+}
+
+wxSize SevenSegmentDisplay::GetRenderSize(const Layout& layout)
+{
+	const auto width = layout.digitSpacing + (layout.digitSpacing + layout.digitSize.GetWidth()) * layout.digitCount + 1;
+	const auto height = layout.digitSize.GetHeight() + layout.digitSpacing * 2 + 1;
+
+	return { width, height };
+}
+
+wxImage SevenSegmentDisplay::RenderToImage(const Appearance& appearance, const unsigned short value)
+{
+	wxImage image(GetRenderSize(appearance.layout));
+
+	{
+		const auto gc = std::unique_ptr<wxGraphicsContext>(wxGraphicsContext::Create(image));
+		if (!gc) return {};
+
+		Draw(*gc, appearance, value, image.GetSize());
+	}
+
+	return image;
+}
+
 void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEvent& event)
 {
 	const wxAutoBufferedPaintDC dc(this);
 	const auto gc = std::unique_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
-	gc->SetAntialiasMode(wxANTIALIAS_DEFAULT);
+	if (!gc) return;
 
-	gc->SetBrush(GetParent()->GetBackgroundColour());
-	gc->SetPen(GetParent()->GetBackgroundColour());
-	gc->DrawRectangle(0, 0, GetClientSize().GetWidth(), GetClientSize().GetHeight());
+	Draw(*gc, GetAppearance(), m_value, GetClientSize());
+}
 
-	gc->SetBrush(GetBackgroundColour());
-	gc->SetPen(GetBackgroundColour());
-	gc->DrawRoundedRectangle(0, 0, GetClientSize().GetWidth() - 1, GetClientSize().GetHeight() - 1, 4);
+void SevenSegmentDisplay::Draw(wxGraphicsContext& gc, const Appearance& appearance, const unsigned short value,
+	const wxSize size)
+{
+	const auto digitCount = appearance.layout.digitCount;
+	const auto digitSpacing = appearance.layout.digitSpacing;
+	const auto segmentThickness = appearance.layout.segmentThickness;
+	const auto digitSize = appearance.layout.digitSize;
 
-	const auto halfHeight = m_digitSize.GetHeight() / 2;
-	auto valueText = std::to_string(m_value);
-	const auto litColor = GetForegroundColour();
+	gc.SetAntialiasMode(wxANTIALIAS_DEFAULT);
+
+	gc.SetBrush(appearance.surroundColor);
+	gc.SetPen(appearance.surroundColor);
+	gc.DrawRectangle(0, 0, size.GetWidth(), size.GetHeight());
+
+	gc.SetBrush(appearance.backgroundColor);
+	gc.SetPen(appearance.backgroundColor);
+	gc.DrawRoundedRectangle(0, 0, size.GetWidth() - 1, size.GetHeight() - 1, 4);
+
+	const auto halfHeight = digitSize.GetHeight() / 2;
+	auto valueText = std::to_string(value);
+	const auto litColor = appearance.foregroundColor;
 	const auto unlitColor = litColor.ChangeLightness(20);
 
-	if (valueText.length() > m_digitCount)
+	if (valueText.length() > digitCount)
 	{
-		valueText = valueText.substr(valueText.length() - m_digitCount);
+		valueText = valueText.substr(valueText.length() - digitCount);
 	}
-	else if (valueText.length() < m_digitCount)
+	else if (valueText.length() < digitCount)
 	{
-		const auto paddingChar = m_leadingZerosVisible ? '0' : ' ';
-		valueText.insert(0, m_digitCount - valueText.length(), paddingChar);
+		const auto paddingChar = appearance.layout.leadingZerosVisible ? '0' : ' ';
+		valueText.insert(0, digitCount - valueText.length(), paddingChar);
 	}
 
-	const auto digitOriginY = m_digitSpacing;
+	const auto digitOriginY = digitSpacing;
 
-	for (auto digitIndex = 0; digitIndex < m_digitCount; digitIndex++)
+	for (auto digitIndex = 0; digitIndex < digitCount; digitIndex++)
 	{
 		const auto digit = valueText[digitIndex];
-		const auto digitSegments = s_digitSegmentMap[digit];
+		const auto& digitSegments = s_digitSegmentMap.at(digit);
 
-		const auto digitOriginX = m_digitSpacing + (m_digitSpacing + m_digitSize.GetWidth()) * digitIndex;
+		const auto digitOriginX = digitSpacing + (digitSpacing + digitSize.GetWidth()) * digitIndex;
 
 		for (const auto segment : { SEGMENT_LIST })
 		{
-			auto segmentPath = gc->CreatePath();
+			auto segmentPath = gc.CreatePath();
 
 			switch (segment)
 			{
 				case TOP:
 				{
 					segmentPath.MoveToPoint(digitOriginX + 1, digitOriginY);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - 1, digitOriginY);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - 1 - m_segmentThickness, digitOriginY + m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX + 1 + m_segmentThickness, digitOriginY + m_segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - 1, digitOriginY);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - 1 - segmentThickness, digitOriginY + segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + 1 + segmentThickness, digitOriginY + segmentThickness);
 
 					break;
 				}
@@ -124,8 +164,8 @@ void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEv
 				case TOP_LEFT:
 				{
 					segmentPath.MoveToPoint(digitOriginX, digitOriginY + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + m_segmentThickness + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + halfHeight - m_segmentThickness - 1);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + segmentThickness + 1);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + halfHeight - segmentThickness - 1);
 					segmentPath.AddLineToPoint(digitOriginX, digitOriginY + halfHeight - 1);
 
 					break;
@@ -133,10 +173,10 @@ void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEv
 
 				case TOP_RIGHT:
 				{
-					segmentPath.MoveToPoint(digitOriginX + m_digitSize.GetWidth(), digitOriginY + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + m_segmentThickness + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + halfHeight - m_segmentThickness - 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth(), digitOriginY + halfHeight - 1);
+					segmentPath.MoveToPoint(digitOriginX + digitSize.GetWidth(), digitOriginY + 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + segmentThickness + 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + halfHeight - segmentThickness - 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth(), digitOriginY + halfHeight - 1);
 
 					break;
 				}
@@ -144,11 +184,11 @@ void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEv
 				case MIDDLE:
 				{
 					segmentPath.MoveToPoint(digitOriginX + 1, digitOriginY + halfHeight);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + halfHeight - m_segmentThickness + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + halfHeight - m_segmentThickness + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - 1, digitOriginY + halfHeight);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + halfHeight + m_segmentThickness - 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + halfHeight + m_segmentThickness - 1);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + halfHeight - segmentThickness + 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + halfHeight - segmentThickness + 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - 1, digitOriginY + halfHeight);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + halfHeight + segmentThickness - 1);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + halfHeight + segmentThickness - 1);
 
 					break;
 				}
@@ -156,29 +196,29 @@ void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEv
 				case BOTTOM_LEFT:
 				{
 					segmentPath.MoveToPoint(digitOriginX, digitOriginY + halfHeight + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + halfHeight + 1 + m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX + m_segmentThickness, digitOriginY + m_digitSize.GetHeight() - 1 - m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX, digitOriginY + m_digitSize.GetHeight() - 1);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + halfHeight + 1 + segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + segmentThickness, digitOriginY + digitSize.GetHeight() - 1 - segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX, digitOriginY + digitSize.GetHeight() - 1);
 
 					break;
 				}
 
 				case BOTTOM_RIGHT:
 				{
-					segmentPath.MoveToPoint(digitOriginX + m_digitSize.GetWidth(), digitOriginY + halfHeight + 1);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + halfHeight + 1 + m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - m_segmentThickness, digitOriginY + m_digitSize.GetHeight() - 1 - m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth(), digitOriginY + m_digitSize.GetHeight() - 1);
+					segmentPath.MoveToPoint(digitOriginX + digitSize.GetWidth(), digitOriginY + halfHeight + 1);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + halfHeight + 1 + segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - segmentThickness, digitOriginY + digitSize.GetHeight() - 1 - segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth(), digitOriginY + digitSize.GetHeight() - 1);
 
 					break;
 				}
 
 				case BOTTOM:
 				{
-					segmentPath.MoveToPoint(digitOriginX + 1, digitOriginY + m_digitSize.GetHeight());
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - 1, digitOriginY + m_digitSize.GetHeight());
-					segmentPath.AddLineToPoint(digitOriginX + m_digitSize.GetWidth() - 1 - m_segmentThickness, digitOriginY + m_digitSize.GetHeight() - m_segmentThickness);
-					segmentPath.AddLineToPoint(digitOriginX + 1 + m_segmentThickness, digitOriginY + m_digitSize.GetHeight() - m_segmentThickness);
+					segmentPath.MoveToPoint(digitOriginX + 1, digitOriginY + digitSize.GetHeight());
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - 1, digitOriginY + digitSize.GetHeight());
+					segmentPath.AddLineToPoint(digitOriginX + digitSize.GetWidth() - 1 - segmentThickness, digitOriginY + digitSize.GetHeight() - segmentThickness);
+					segmentPath.AddLineToPoint(digitOriginX + 1 + segmentThickness, digitOriginY + digitSize.GetHeight() - segmentThickness);
 
 					break;
 				}
@@ -186,17 +226,14 @@ void SevenSegmentDisplay::SevenSegmentDisplay_OnPaint([[maybe_unused]] wxPaintEv
 
 			const auto segmentColor = std::ranges::find(digitSegments, segment) != digitSegments.end() ? litColor : unlitColor;
 
-			gc->SetBrush(segmentColor);
-			gc->SetPen(segmentColor);
-			gc->DrawPath(segmentPath);
+			gc.SetBrush(segmentColor);
+			gc.SetPen(segmentColor);
+			gc.DrawPath(segmentPath);
 		}
 	}
 }
 
 wxSize SevenSegmentDisplay::DoGetBestClientSize() const
 {
-	const auto width = m_digitSpacing + (m_digitSpacing + m_digitSize.GetWidth()) * m_digitCount + 1;
-	const auto height = m_digitSize.GetHeight() + m_digitSpacing * 2 + 1;
-
-	return { width, height };
+	return GetRenderSize(m_layout);
 }
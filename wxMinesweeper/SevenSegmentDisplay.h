@@ -7,13 +7,15 @@
 #include <unordered_map>
 #include <vector>
 
+class wxGraphicsContext;
+
 class SevenSegmentDisplay final : public wxControl
 {
 public:
 #define SEGMENT_LIST TOP, TOP_LEFT, TOP_RIGHT, MIDDLE, BOTTOM_LEFT, BOTTOM_RIGHT, BOTTOM
 	enum Segment : uint8_t { SEGMENT_LIST };
 
-	static inline std::unordered_map<char, std::vector<Segment>> s_digitSegmentMap = {
+	static inline const std::unordered_map<char, std::vector<Segment>> s_digitSegmentMap = {
 		{'0', {TOP, TOP_LEFT, TOP_RIGHT, BOTTOM_LEFT, BOTTOM_RIGHT, BOTTOM}},
 		{'1', {TOP_RIGHT, BOTTOM_RIGHT}},
 		{'2', {TOP, TOP_RIGHT, MIDDLE, BOTTOM_LEFT, BOTTOM}},
@@ -27,27 +29,46 @@ public:
 		{' ', {}}
 	};
 
+	struct Layout
+	{
+		unsigned short digitCount{ 3 };
+		unsigned short digitSpacing{ 5 };
+		unsigned short segmentThickness{ 3 };
+		wxSize digitSize{ 20, 41 };
+		bool leadingZerosVisible{ false };
+	};
+
+	// Everything that affects how the display is drawn, so frames can be rendered without a live control.
+	struct Appearance
+	{
+		Layout layout;
+		wxColour surroundColor;
+		wxColour backgroundColor;
+		wxColour foregroundColor;
+	};
+
 	explicit SevenSegmentDisplay(wxWindow* parent);
 	[[nodiscard]] unsigned short GetValue() const { return m_value; }
 	void SetValue(unsigned short value);
-	[[nodiscard]] unsigned short GetDigitCount() const { return m_digitCount; }
+	[[nodiscard]] unsigned short GetDigitCount() const { return m_layout.digitCount; }
 	void SetDigitCount(unsigned short digitCount);
-	[[nodiscard]] unsigned short GetDigitSpacing() const { return m_digitSpacing; }
+	[[nodiscard]] unsigned short GetDigitSpacing() const { return m_layout.digitSpacing; }
 	void SetDigitSpacing(unsigned short digitSpacing);
-	[[nodiscard]] unsigned short GetSegmentThickness() const { return m_segmentThickness; }
+	[[nodiscard]] unsigned short GetSegmentThickness() const { return m_layout.segmentThickness; }
 	void SetSegmentThickness(unsigned short segmentThickness);
-	[[nodiscard]] wxSize GetDigitSize() const { return m_digitSize; }
+	[[nodiscard]] wxSize GetDigitSize() const { return m_layout.digitSize; }
 	void SetDigitSize(wxSize digitSize);
-	[[nodiscard]] bool GetLeadingZerosVisible() const { return m_leadingZerosVisible; }
+	[[nodiscard]] bool GetLeadingZerosVisible() const { return m_layout.leadingZerosVisible; }
 	void SetLeadingZerosVisible(bool leadingZerosVisible);
+	[[nodiscard]] Appearance GetAppearance() const;
+	[[nodiscard]] static wxSize GetRenderSize(const Layout& layout);
+	// Renders into a wxImage-backed context with no window involved, e.g. for offscreen frame export.
+	[[nodiscard]] static wxImage RenderToImage(const Appearance& appearance, unsigned short value);
+	static void Draw(wxGraphicsContext& gc, const Appearance& appearance, unsigned short value, wxSize size);
 
 private:
 	unsigned short m_value{ 0 };
-	unsigned short m_digitCount{ 3 };
-	unsigned short m_digitSpacing{ 5 };
-	unsigned short m_segmentThickness{ 3 };
-	wxSize m_digitSize{ 20, 41 };
-	bool m_leadingZerosVisible{ false };
+	Layout m_layout;
 
 	void SevenSegmentDisplay_OnPaint(wxPaintEvent& event);
 	[[nodiscard]] wxSize DoGetBestClientSize() const override;